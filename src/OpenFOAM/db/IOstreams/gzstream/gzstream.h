@@ -98,6 +98,11 @@ public:
    virtual int     overflow( int c = EOF );
    virtual int     underflow();
    virtual int     sync();
+
+   // Bulk transfers of blocks larger than the buffer directly
+   // between zlib and the caller's storage
+   virtual std::streamsize xsgetn( char* s, std::streamsize num );
+   virtual std::streamsize xsputn( const char* s, std::streamsize num );
 };
 
 // ----------------------------------------------------------------------------